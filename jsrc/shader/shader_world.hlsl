@@ -52,7 +52,11 @@ struct WORLD_DX_InstanceModel
   U32 pose_offset; // in indices; unused for rigid
 };
 StructuredBuffer<WORLD_DX_InstanceModel> InstanceBuf : register(t0);
-StructuredBuffer<Mat4> SkinningPoseBuf : register(t1);
+struct WORLD_DX_Pose
+{
+  V4 rows[3]; // top 3 rows of an affine joint matrix
+};
+StructuredBuffer<WORLD_DX_Pose> SkinningPoseBuf : register(t1);
 
 WORLD_DX_Fragment WORLD_DxShaderVS(WORLD_DX_Vertex vert)
 {
@@ -79,16 +83,22 @@ WORLD_DX_Fragment WORLD_DxShaderVS(WORLD_DX_Vertex vert)
     joint2 += instance.pose_offset;
     joint3 += instance.pose_offset;
 
-    Mat4 pose_transform0 = SkinningPoseBuf[joint0];
-    Mat4 pose_transform1 = SkinningPoseBuf[joint1];
-    Mat4 pose_transform2 = SkinningPoseBuf[joint2];
-    Mat4 pose_transform3 = SkinningPoseBuf[joint3];
+    WORLD_DX_Pose pose0 = SkinningPoseBuf[joint0];
+    WORLD_DX_Pose pose1 = SkinningPoseBuf[joint1];
+    WORLD_DX_Pose pose2 = SkinningPoseBuf[joint2];
+    WORLD_DX_Pose pose3 = SkinningPoseBuf[joint3];
 
-    Mat4 pose_transform =
-      pose_transform0 * vert.joint_weights.x +
-      pose_transform1 * vert.joint_weights.y +
-      pose_transform2 * vert.joint_weights.z +
-      pose_transform3 * vert.joint_weights.w;
+    // Blend the 3 stored rows; the last row of an affine matrix stays 0,0,0,1
+    V4 pose_rows[3];
+    [unroll] for (U32 row = 0; row < 3; row++)
+    {
+      pose_rows[row] =
+        pose0.rows[row] * vert.joint_weights.x +
+        pose1.rows[row] * vert.joint_weights.y +
+        pose2.rows[row] * vert.joint_weights.z +
+        pose3.rows[row] * vert.joint_weights.w;
+    }
+    Mat4 pose_transform = Mat4(pose_rows[0], pose_rows[1], pose_rows[2], V4(0.0f, 0.0f, 0.0f, 1.0f));
 
     position_transform = mul(position_transform, pose_transform);
   }